@@ -0,0 +1,14 @@
+#ifndef COMPRESSION_H
+#define COMPRESSION_H
+
+#include <string>
+
+namespace Compression {
+    // Fast LZ77 block compression (LZ4-style token format, no external library)
+    std::string compress(const std::string& input);
+
+    // Reverses compress(); returns false if the block is truncated or corrupt
+    bool decompress(const std::string& input, std::string& output);
+}
+
+#endif
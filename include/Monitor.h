@@ -5,10 +5,13 @@
 #include <mutex>
 #include <chrono>
 #include <vector>
+#include <cstdio>
 
 #ifdef _WIN32
     #include <winsock2.h>
     #pragma comment(lib, "ws2_32.lib")
+#else
+    #include "SensorReader.h"
 #endif
 
 /**
@@ -20,6 +23,16 @@ struct DiskStatus {
     double percent_used;
 };
 
+/**
+ * Alert log rotation limits (0 disables a limit)
+ */
+struct LogRotationPolicy {
+    unsigned long long max_segment_bytes = 1024 * 1024;        // Seal the active log past this size
+    long long max_segment_age_seconds = 24 * 60 * 60;          // ...or once it is this old
+    unsigned long long retention_bytes = 16ULL * 1024 * 1024;  // Disk budget for sealed segments
+    long long seal_retry_seconds = 60;                         // Back-off after a failed seal
+};
+
 /**
  * Notification severity levels
  */
@@ -34,7 +47,7 @@ enum class NotificationLevel {
  * Responsibilities:
  * 1. Tracking system CPU load (Universal).
  * 2. Encrypting alert messages using XOR logic.
- * 3. Thread-safe logging of alerts to a file.
+ * 3. Thread-safe logging of alerts to a rotated, size-bounded file.
  * 4. Checking Database connectivity.
  * 5. Monitoring Disk Space availability.
  * 6. Sending system notifications.
@@ -45,6 +58,15 @@ private:
     float load_threshold;        // User-defined limit (e.g., 0.75 for 75% load)
     float ram_threshold;         // User-defined RAM limit (e.g., 80.0 for 80%)
     std::string log_filename;    // The file path where logs will be stored
+
+    // --- Log Rotation ---
+    LogRotationPolicy rotation;  // Segment size/age limits and retention budget
+    std::FILE* log_stream;       // Active segment, kept open between alerts
+    unsigned long long segment_bytes;                    // Alert bytes in the active segment (header excluded)
+    std::chrono::system_clock::time_point segment_started; // From the segment header, so it survives restarts
+    std::chrono::steady_clock::time_point seal_retry_after; // No seal attempts before this (set on failure)
+    unsigned long long next_segment_seq;                 // Sequence number for the next sealed segment (0 = not scanned yet)
+    unsigned long long dropped_alerts;                   // Alerts refused while the active segment was full
     
     // --- Security ---
     std::string key;             // The secret key used for XOR encryption/decryption
@@ -54,10 +76,32 @@ private:
     std::mutex mtx;              // Prevents multiple threads from writing to the log file 
                                  // simultaneously (avoids data corruption)
 
-    // Reads and parses system load (Windows: RAM% | Linux: /proc/loadavg)
+#ifndef _WIN32
+    // --- Sensors ---
+    SensorReader sensors;        // /proc files kept open and re-read as one batch per tick
+                                 // (io_uring when available, pread otherwise)
+#endif
+
+    // Opens (and preallocates) the active log segment, writing its header if new
+    bool open_active_segment();
+
+    // Closes the active segment and stores it compressed + encrypted as <log>.<seq>.seg.
+    // On failure the active file is left untouched and false is returned.
+    bool seal_active_segment();
+
+    // Appends one line to the active segment
+    bool append_line(const std::string& line);
+
+    // Deletes the oldest sealed segments until they plus 'incoming' bytes fit the retention budget
+    void enforce_retention(unsigned long long incoming = 0);
+
+    // Refreshes all sensor buffers in one batch (no-op on Windows)
+    void refresh_sensors();
+
+    // Parses system load from the last refresh (Windows: RAM% | Linux: /proc/loadavg)
     float read_system_load();
 
-    // Reads and parses RAM usage percentage (Linux: /proc/meminfo)
+    // Parses RAM usage percentage from the last refresh (Linux: /proc/meminfo)
     float read_ram_usage();
 
 public:
@@ -66,13 +110,30 @@ public:
      * @param threshold: CPU load limit
      * @param log_file: Destination for encrypted alerts
      * @param encryption_key: The secret key for data safety
+     * @param policy: Log segment rotation and retention limits
      */
-    Monitor(float threshold, float ram_limit, const std::string& log_file, const std::string& encryption_key) 
-        : load_threshold(threshold), ram_threshold(ram_limit), log_filename(log_file), key(encryption_key) {}
+    Monitor(float threshold, float ram_limit, const std::string& log_file, const std::string& encryption_key,
+            const LogRotationPolicy& policy = LogRotationPolicy()) 
+        : load_threshold(threshold), ram_threshold(ram_limit), log_filename(log_file),
+          rotation(policy), log_stream(nullptr), segment_bytes(0), next_segment_seq(0), dropped_alerts(0),
+          key(encryption_key)
+#ifndef _WIN32
+        , sensors({"/proc/loadavg", "/proc/meminfo"})
+#endif
+        {}
+
+    ~Monitor();
 
     // Public method to manually log an encrypted alert (thread-safe)
     void log_alert(const std::string& message);
 
+    /**
+     * Reads back a sealed segment (<log>.<seq>.seg).
+     * @return The alert lines, or an empty vector if the file is unreadable,
+     *         encrypted with another key, or corrupt.
+     */
+    std::vector<std::string> read_sealed_segment(const std::string& path) const;
+
     // Starts an infinite loop that monitors load and sleeps for 'interval_seconds'
     void run_monitoring_cycle(int interval_seconds);
 
@@ -90,11 +151,13 @@ public:
 
     // Inline getter to check the current system load without starting a full cycle
     float get_current_load() { 
+        refresh_sensors();
         return read_system_load(); 
     }
 
     // Inline getter to check the current RAM usage
     float get_current_ram() {
+        refresh_sensors();
         return read_ram_usage();
     }
 
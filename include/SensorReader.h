@@ -0,0 +1,81 @@
+#ifndef SENSOR_READER_H
+#define SENSOR_READER_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/**
+ * SensorReader Class
+ * Responsibilities:
+ * 1. Opening every sensor file (/proc, sysfs) once and keeping it open.
+ * 2. Re-reading all of them per tick into fixed, pre-allocated buffers.
+ * 3. Batching those reads through io_uring (one submit per tick) when the
+ *    kernel allows it, falling back to one pread() per file otherwise.
+ *
+ * Linux only: Windows sensors go through native APIs instead.
+ */
+class SensorReader {
+private:
+    std::vector<std::string> paths;   // Sensor file paths, in registration order
+    std::vector<int> fds;             // Open descriptors (-1 if the open failed)
+    std::vector<char> buffers;        // One contiguous block, buffer_size bytes per file
+    std::vector<long> lengths;        // Bytes read on the last tick (-1 on failure)
+    std::vector<std::string> overflow; // Tail of files larger than buffer_size
+    std::size_t buffer_size;          // Capacity of each per-file buffer
+
+    // --- io_uring state (unused when the pread fallback is active) ---
+    int ring_fd;                      // -1 when io_uring is unavailable
+    unsigned ring_entries;            // Submission queue depth
+    void* sq_ring;                    // mmap'd submission ring
+    void* cq_ring;                    // mmap'd completion ring (may alias sq_ring)
+    void* sqes;                       // mmap'd submission queue entries
+    std::size_t sq_ring_size;
+    std::size_t cq_ring_size;
+    std::size_t sqes_size;
+    unsigned* sq_tail;                // Ring pointers resolved once from the setup offsets
+    unsigned* sq_array;
+    unsigned sq_mask;
+    unsigned* cq_head;
+    unsigned* cq_tail;
+    unsigned cq_mask;
+    void* cqes;
+
+    // Sets up the ring and registers descriptors and buffers; false on any failure
+    bool setup_io_uring();
+
+    // Unmaps and closes the ring, leaving the reader on the pread path
+    void teardown_io_uring();
+
+    // Submits every read for this tick as batches of ring_entries
+    bool read_all_io_uring();
+
+    // Synchronous fallback: one pread() per open file
+    void read_one_pread(std::size_t index);
+
+    // Reads the rest of a file that filled its fixed buffer
+    void read_overflow(std::size_t index);
+
+public:
+    /**
+     * Constructor
+     * @param sensor_paths: Files to sample on every tick
+     * @param buf_size: Per-file buffer capacity (larger files cost extra preads)
+     */
+    explicit SensorReader(const std::vector<std::string>& sensor_paths, std::size_t buf_size = 4096);
+    ~SensorReader();
+
+    SensorReader(const SensorReader&) = delete;
+    SensorReader& operator=(const SensorReader&) = delete;
+
+    // Refreshes every registered file; returns false if no file could be read
+    bool read_all();
+
+    // Full contents of file 'index' from the last read_all() ("" on failure)
+    std::string contents(std::size_t index) const;
+
+    // True if reads are being batched through io_uring
+    bool using_io_uring() const { return ring_fd >= 0; }
+};
+
+#endif
@@ -0,0 +1,143 @@
+#include "../include/Compression.h"
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * Block layout:
+ *   [4 bytes] original size (little-endian)
+ *   sequences of: token | literal length ext | literals | offset (2 bytes) | match length ext
+ * The token's high nibble is the literal length, the low nibble the match
+ * length minus MIN_MATCH; a nibble of 15 continues in 255-terminated bytes.
+ * The final sequence carries literals only and has no offset.
+ */
+static const std::size_t MIN_MATCH = 4;
+static const std::size_t MAX_OFFSET = 65535;
+static const unsigned HASH_BITS = 14;
+
+// Upper bound on output bytes per input byte: one 255 length-extension byte
+// adds at most 255 bytes of match, everything else expands less
+static const std::size_t MAX_EXPANSION = 255;
+
+static uint32_t read32(const char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint32_t hash32(uint32_t v) {
+    return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+static void write_length(std::string& out, std::size_t len) {
+    while (len >= 255) {
+        out.push_back((char)255);
+        len -= 255;
+    }
+    out.push_back((char)len);
+}
+
+static void emit_sequence(std::string& out, const char* literals, std::size_t lit_len,
+                          std::size_t offset, std::size_t match_len, bool last) {
+    std::size_t match_code = last ? 0 : match_len - MIN_MATCH;
+    unsigned char token = (unsigned char)(((lit_len < 15 ? lit_len : 15) << 4) |
+                                          (match_code < 15 ? match_code : 15));
+    out.push_back((char)token);
+    if (lit_len >= 15) write_length(out, lit_len - 15);
+    out.append(literals, lit_len);
+    if (last) return;
+
+    out.push_back((char)(offset & 0xFF));
+    out.push_back((char)((offset >> 8) & 0xFF));
+    if (match_code >= 15) write_length(out, match_code - 15);
+}
+
+std::string Compression::compress(const std::string& input) {
+    const char* src = input.data();
+    const std::size_t n = input.size();
+
+    std::string out;
+    out.reserve(n / 2 + 16);
+    for (int i = 0; i < 4; ++i) out.push_back((char)((n >> (8 * i)) & 0xFF));
+
+    // Most recent position (+1, so 0 means empty) for each 4-byte hash
+    std::vector<uint32_t> table(1u << HASH_BITS, 0);
+
+    std::size_t anchor = 0;
+    std::size_t ip = 0;
+    while (ip + MIN_MATCH <= n) {
+        uint32_t seq = read32(src + ip);
+        uint32_t h = hash32(seq);
+        std::size_t ref = table[h];
+        table[h] = (uint32_t)(ip + 1);
+
+        if (ref != 0 && ip - (ref - 1) <= MAX_OFFSET && read32(src + ref - 1) == seq) {
+            std::size_t match = ref - 1;
+            std::size_t len = MIN_MATCH;
+            while (ip + len < n && src[match + len] == src[ip + len]) ++len;
+
+            emit_sequence(out, src + anchor, ip - anchor, ip - match, len, false);
+            ip += len;
+            anchor = ip;
+        } else {
+            ++ip;
+        }
+    }
+
+    emit_sequence(out, src + anchor, n - anchor, 0, 0, true);
+    return out;
+}
+
+static bool read_length(const std::string& in, std::size_t& pos, std::size_t& len) {
+    unsigned char b;
+    do {
+        if (pos >= in.size()) return false;
+        b = (unsigned char)in[pos++];
+        len += b;
+    } while (b == 255);
+    return true;
+}
+
+bool Compression::decompress(const std::string& input, std::string& output) {
+    output.clear();
+    if (input.size() < 5) return false;
+
+    std::size_t expected = 0;
+    for (int i = 0; i < 4; ++i) expected |= (std::size_t)(unsigned char)input[i] << (8 * i);
+
+    // The header is untrusted: a valid block expands at most MAX_EXPANSION x,
+    // so reject sizes that could not have come from compress()
+    if (expected > (input.size() - 4) * MAX_EXPANSION) return false;
+    output.reserve(expected);
+
+    std::size_t pos = 4;
+    while (pos < input.size()) {
+        unsigned char token = (unsigned char)input[pos++];
+
+        // --- Literals ---
+        std::size_t lit_len = token >> 4;
+        if (lit_len == 15 && !read_length(input, pos, lit_len)) return false;
+        if (lit_len > input.size() - pos) return false;
+        if (output.size() + lit_len > expected) return false;
+        output.append(input, pos, lit_len);
+        pos += lit_len;
+        if (pos == input.size()) break; // Final literal-only sequence
+
+        // --- Match ---
+        if (input.size() - pos < 2) return false;
+        std::size_t offset = (unsigned char)input[pos] | ((std::size_t)(unsigned char)input[pos + 1] << 8);
+        pos += 2;
+        std::size_t match_len = token & 0x0F;
+        if (match_len == 15 && !read_length(input, pos, match_len)) return false;
+        match_len += MIN_MATCH;
+
+        if (offset == 0 || offset > output.size()) return false;
+        if (output.size() + match_len > expected) return false;
+
+        // Byte-by-byte copy: overlapping matches (offset < length) repeat the pattern
+        std::size_t from = output.size() - offset;
+        for (std::size_t i = 0; i < match_len; ++i) output.push_back(output[from + i]);
+    }
+
+    return output.size() == expected;
+}
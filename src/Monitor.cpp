@@ -1,4 +1,5 @@
 #include "../include/Monitor.h"
+#include "../include/Compression.h"
 #include <iostream>
 #include <fstream>
 #include <thread>
@@ -21,20 +22,46 @@
     #include <netinet/in.h>  // For IP address structures
     #include <arpa/inet.h>   // For IP address conversion
     #include <cstdlib>       // For system() command
+    #include <fcntl.h>       // For fallocate() log preallocation and directory fsync
 #endif
 
 #include <vector>
 #include <iomanip>
 #include <sstream>
+#include <filesystem>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <charconv>
+#include <cerrno>
 #include <openssl/evp.h>
 #include <openssl/sha.h>
 #include <openssl/rand.h>
 
 
+#ifndef _WIN32
+// Indices into the sensor list registered by the Monitor constructor
+static const std::size_t SENSOR_LOADAVG = 0;
+static const std::size_t SENSOR_MEMINFO = 1;
+#endif
+
+/**
+ * @brief Refreshes every Linux sensor file for the current tick.
+ * * All registered /proc files are re-read in a single batch (one io_uring
+ * submit, or one pread per file as fallback) so that the read_* parsers
+ * below work on a consistent snapshot without any open/close syscalls.
+ */
+void Monitor::refresh_sensors() {
+#ifndef _WIN32
+    sensors.read_all();
+#endif
+}
+
 /**
  * @brief Reads the current system workload.
  * * Windows: Retrieves the percentage of physical memory currently in use.
  * Linux: Parses the first float from /proc/loadavg (1-minute CPU load average).
+ * * Call refresh_sensors() first; this only parses the last snapshot.
  * * @return float: Percentage (0-100) or Load Average. Returns -1.0 on failure.
  */
 float Monitor::read_system_load() {
@@ -47,12 +74,10 @@ float Monitor::read_system_load() {
     }
     return -1.0f;
 #else
-    // Linux virtual file system read
-    std::ifstream file("/proc/loadavg");
+    // Linux virtual file system read (buffered by refresh_sensors)
+    std::istringstream file(sensors.contents(SENSOR_LOADAVG));
     float load = 0.0f;
-    if (!file.is_open()) return -1.0f;
     if (file >> load) {
-        file.close();
         return load;
     }
     return -1.0f;
@@ -68,8 +93,7 @@ float Monitor::read_ram_usage() {
 #ifdef _WIN32
     return read_system_load();
 #else
-    std::ifstream file("/proc/meminfo");
-    if (!file.is_open()) return -1.0f;
+    std::istringstream file(sensors.contents(SENSOR_MEMINFO));
 
     std::string line;
     unsigned long long total_mem = 0, free_mem = 0, buffers = 0, cached = 0;
@@ -80,7 +104,6 @@ float Monitor::read_ram_usage() {
         else if (line.find("Buffers:") == 0) sscanf(line.c_str(), "Buffers: %llu", &buffers);
         else if (line.find("Cached:") == 0) sscanf(line.c_str(), "Cached: %llu", &cached);
     }
-    file.close();
 
     if (total_mem == 0) return -1.0f;
 
@@ -198,10 +221,342 @@ static std::string to_hex(const std::string& input) {
 }
 
 
+static std::string aes_256_decrypt(const std::string& data, const std::string& secret) {
+    if (data.size() <= 16) return "";
+    auto key = derive_aes_key(secret);
+    const unsigned char* iv = (const unsigned char*)data.data();
+
+    EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+    EVP_DecryptInit_ex(ctx, EVP_aes_256_cbc(), NULL, key.data(), iv);
+
+    std::vector<unsigned char> plaintext(data.length() + EVP_MAX_BLOCK_LENGTH);
+    int len, plaintext_len;
+    EVP_DecryptUpdate(ctx, plaintext.data(), &len, (const unsigned char*)data.data() + 16, data.length() - 16);
+    plaintext_len = len;
+    int ok = EVP_DecryptFinal_ex(ctx, plaintext.data() + len, &len);
+    plaintext_len += len;
+    EVP_CIPHER_CTX_free(ctx);
+
+    if (ok != 1) return "";
+    return std::string((char*)plaintext.data(), plaintext_len);
+}
+
+static std::string from_hex(const std::string& input) {
+    std::string out;
+    if (input.size() % 2 != 0) return out;
+    out.reserve(input.size() / 2);
+    for (std::size_t i = 0; i < input.size(); i += 2) {
+        char* end = nullptr;
+        std::string byte = input.substr(i, 2);
+        long value = std::strtol(byte.c_str(), &end, 16);
+        if (end != byte.c_str() + 2) return "";
+        out.push_back((char)value);
+    }
+    return out;
+}
+
+/**
+ * Sealed segment on disk: <log_filename>.<seq>.seg
+ */
+struct SegmentFile {
+    unsigned long long seq;
+    std::filesystem::path path;
+    unsigned long long size;
+};
+
+// Lists sealed segments belonging to 'log_filename', oldest first
+static std::vector<SegmentFile> list_segments(const std::string& log_filename) {
+    namespace fs = std::filesystem;
+    std::vector<SegmentFile> segments;
+
+    fs::path log_path(log_filename);
+    fs::path dir = log_path.has_parent_path() ? log_path.parent_path() : fs::path(".");
+    std::string prefix = log_path.filename().string() + ".";
+    const std::string suffix = ".seg";
+
+    std::error_code ec;
+    for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+        std::string name = it->path().filename().string();
+        if (name.size() <= prefix.size() + suffix.size()) continue;
+        if (name.compare(0, prefix.size(), prefix) != 0) continue;
+        if (name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) continue;
+
+        std::string digits = name.substr(prefix.size(), name.size() - prefix.size() - suffix.size());
+        if (!std::all_of(digits.begin(), digits.end(),
+                         [](unsigned char c) { return std::isdigit(c); })) continue;
+
+        // Skip names whose sequence number does not fit (from_chars does not throw)
+        unsigned long long seq = 0;
+        auto parsed = std::from_chars(digits.data(), digits.data() + digits.size(), seq);
+        if (parsed.ec != std::errc() || parsed.ptr != digits.data() + digits.size()) continue;
+
+        std::error_code size_ec;
+        unsigned long long size = fs::file_size(it->path(), size_ec);
+        segments.push_back({seq, it->path(), size_ec ? 0 : size});
+    }
+
+    std::sort(segments.begin(), segments.end(),
+              [](const SegmentFile& a, const SegmentFile& b) { return a.seq < b.seq; });
+    return segments;
+}
+
+// First line of every active segment; records when the segment was started
+static const std::string SEGMENT_HEADER_PREFIX = "#segment-start ";
+
+/**
+ * @brief Writes 'data' to 'path' and makes it durable before returning.
+ * * Every step (write, flush, fsync, close) is checked, so ENOSPC/EIO that
+ * only surfaces on flush or close is reported instead of silently lost.
+ * @return 0 on success, otherwise the errno of the first failing step.
+ */
+static int write_file_synced(const std::string& path, const std::string& data) {
+    std::FILE* out = std::fopen(path.c_str(), "wb");
+    if (!out) return errno ? errno : EIO;
+
+    int err = 0;
+    if (std::fwrite(data.data(), 1, data.size(), out) != data.size()) err = errno ? errno : EIO;
+    if (std::fflush(out) != 0 && !err) err = errno ? errno : EIO;
+#ifndef _WIN32
+    if (!err && fsync(fileno(out)) != 0) err = errno ? errno : EIO;
+#endif
+    if (std::fclose(out) != 0 && !err) err = errno ? errno : EIO;
+    return err;
+}
+
+// Persists a rename/unlink in 'dir' (no-op on Windows)
+static void sync_directory(const std::filesystem::path& dir) {
+#ifndef _WIN32
+    int fd = open(dir.empty() ? "." : dir.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return;
+    fsync(fd);
+    close(fd);
+#else
+    (void)dir;
+#endif
+}
+
+Monitor::~Monitor() {
+    if (log_stream) std::fclose(log_stream);
+}
+
+/**
+ * @brief Opens the active log segment for appending and keeps it open.
+ * * A new segment starts with a "#segment-start <unix time>" header so its age
+ * survives restarts; an existing file without one (written before rotation
+ * existed) is treated as already due for sealing.
+ * * Linux: reserves max_segment_bytes up front with fallocate(KEEP_SIZE) so
+ * appends do not allocate blocks one at a time, and a full volume is
+ * detected when the segment opens rather than mid-alert.
+ */
+bool Monitor::open_active_segment() {
+    if (next_segment_seq == 0) {
+        auto segments = list_segments(log_filename);
+        next_segment_seq = segments.empty() ? 1 : segments.back().seq + 1;
+    }
+
+    // Recover the start time from an existing segment's header
+    unsigned long long header_bytes = 0;
+    segment_started = std::chrono::system_clock::time_point();
+    {
+        std::ifstream existing(log_filename, std::ios::binary);
+        std::string first;
+        if (existing.is_open() && std::getline(existing, first) &&
+            first.compare(0, SEGMENT_HEADER_PREFIX.size(), SEGMENT_HEADER_PREFIX) == 0) {
+            long long started = 0;
+            const char* digits = first.data() + SEGMENT_HEADER_PREFIX.size();
+            auto parsed = std::from_chars(digits, first.data() + first.size(), started);
+            if (parsed.ec == std::errc()) {
+                segment_started = std::chrono::system_clock::time_point(std::chrono::seconds(started));
+            }
+            header_bytes = first.size() + 1;
+        }
+    }
+
+    // Binary append mode prevents OS-specific line-ending corruption
+    log_stream = std::fopen(log_filename.c_str(), "ab");
+    if (!log_stream) return false;
+
+    std::fseek(log_stream, 0, SEEK_END);
+    long existing = std::ftell(log_stream);
+    unsigned long long file_bytes = existing > 0 ? (unsigned long long)existing : 0;
+
+    if (file_bytes == 0) {
+        auto now = std::chrono::system_clock::now();
+        long long started = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+        std::string header = SEGMENT_HEADER_PREFIX + std::to_string(started) + "\n";
+        if (std::fwrite(header.data(), 1, header.size(), log_stream) != header.size() ||
+            std::fflush(log_stream) != 0) {
+            // The file held no alerts, so drop it rather than leave a partial header
+            std::fclose(log_stream);
+            log_stream = nullptr;
+            std::error_code ec;
+            std::filesystem::remove(log_filename, ec);
+            return false;
+        }
+        segment_started = std::chrono::system_clock::time_point(std::chrono::seconds(started));
+        header_bytes = header.size();
+        file_bytes = header.size();
+    }
+    segment_bytes = file_bytes > header_bytes ? file_bytes - header_bytes : 0;
+
+#ifdef __linux__
+    if (rotation.max_segment_bytes > file_bytes) {
+        // Best effort: unsupported filesystems or ENOSPC just skip preallocation
+        fallocate(fileno(log_stream), FALLOC_FL_KEEP_SIZE, 0, (off_t)(rotation.max_segment_bytes + header_bytes));
+    }
+#endif
+    return true;
+}
+
+/**
+ * @brief Seals the active segment: decrypt lines -> compress -> encrypt once.
+ * * Per-line ciphertext does not compress, so the lines are decrypted and the
+ * whole segment is compressed before a single AES pass. The result is written
+ * and fsync'd to a temp file, renamed into place, and only then is the active
+ * file removed. Lines that fail to decrypt are kept as their original hex.
+ * * Before writing, old segments are evicted so that the retention budget also
+ * holds with the new segment counted. If the write still hits ENOSPC, the
+ * oldest remaining segment is evicted (even with no budget set) and the write
+ * is retried once, so a full volume trades old alerts for new ones.
+ * @return false if the sealed segment could not be written; the active file
+ *         is left in place and the caller decides when to retry.
+ */
+bool Monitor::seal_active_segment() {
+    namespace fs = std::filesystem;
+
+    if (log_stream) {
+        std::fclose(log_stream);
+        log_stream = nullptr;
+    }
+    segment_bytes = 0;
+
+    std::ifstream active(log_filename, std::ios::binary);
+    if (!active.is_open()) return false;
+
+    std::string plaintext;
+    std::string line;
+    while (std::getline(active, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::string decrypted = aes_256_decrypt(from_hex(line), key);
+        plaintext += decrypted.empty() ? line : decrypted;
+        plaintext += "\n";
+    }
+    active.close();
+
+    std::error_code ec;
+    if (plaintext.empty()) {
+        fs::remove(log_filename, ec);
+        return true;
+    }
+
+    std::string sealed = aes_256_encrypt(Compression::compress(plaintext), key);
+    if (sealed.empty()) return false;
+
+    enforce_retention(sealed.size());
+
+    std::string segment_path = log_filename + "." + std::to_string(next_segment_seq) + ".seg";
+    std::string temp_path = segment_path + ".tmp";
+    int err = write_file_synced(temp_path, sealed);
+    if (err == ENOSPC) {
+        fs::remove(temp_path, ec);
+        auto segments = list_segments(log_filename);
+        if (!segments.empty() && fs::remove(segments.front().path, ec)) {
+            err = write_file_synced(temp_path, sealed);
+        }
+    }
+    if (err != 0) {
+        fs::remove(temp_path, ec);
+        return false;
+    }
+
+    fs::rename(temp_path, segment_path, ec);
+    if (ec) {
+        fs::remove(temp_path, ec);
+        return false;
+    }
+    sync_directory(fs::path(segment_path).parent_path());
+    ++next_segment_seq;
+
+    // The lines now live in the sealed segment; the active file must not be
+    // reused, or they would be sealed a second time. Truncate if removal fails.
+    fs::remove(log_filename, ec);
+    if (ec) {
+        fs::resize_file(log_filename, 0, ec);
+        if (ec) {
+            std::cerr << "[Monitor] Could not clear " << log_filename
+                      << " after sealing; its alerts may appear in two segments.\n";
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Deletes the oldest sealed segments until they fit the budget.
+ * * @param incoming: Size of a segment about to be written, counted against
+ * the budget so space is freed before the write instead of after. If the
+ * incoming segment alone exceeds the budget, every older one is evicted.
+ */
+void Monitor::enforce_retention(unsigned long long incoming) {
+    if (rotation.retention_bytes == 0) return;
+
+    auto segments = list_segments(log_filename);
+    unsigned long long total = incoming;
+    for (const auto& seg : segments) total += seg.size;
+
+    std::error_code ec;
+    for (const auto& seg : segments) {
+        if (total <= rotation.retention_bytes) break;
+        if (std::filesystem::remove(seg.path, ec)) total -= seg.size;
+    }
+}
+
+bool Monitor::append_line(const std::string& line) {
+    bool ok = std::fwrite(line.data(), 1, line.size(), log_stream) == line.size();
+    // With a buffered FILE*, ENOSPC/EIO usually only shows up here
+    ok = (std::fflush(log_stream) == 0) && ok;
+    if (!ok) {
+        std::clearerr(log_stream);
+        return false;
+    }
+    segment_bytes += line.size();
+    return true;
+}
+
+/**
+ * @brief Reads a sealed segment back into its alert lines.
+ * * Reverses seal_active_segment(): AES-256 decrypt, then decompress.
+ */
+std::vector<std::string> Monitor::read_sealed_segment(const std::string& path) const {
+    std::vector<std::string> lines;
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) return lines;
+    std::ostringstream raw;
+    raw << in.rdbuf();
+
+    std::string compressed = aes_256_decrypt(raw.str(), key);
+    std::string plaintext;
+    if (compressed.empty() || !Compression::decompress(compressed, plaintext)) return lines;
+
+    std::istringstream stream(plaintext);
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (!line.empty()) lines.push_back(line);
+    }
+    return lines;
+}
+
 /**
  * @brief Logs encrypted messages to a file in a thread-safe manner.
  * * Uses std::lock_guard to prevent race conditions if multiple threads 
  * attempt to write to the same file simultaneously.
+ * * The active segment stays open between alerts. Sealing is lazy: limits are
+ * only checked when an alert arrives, so a quiet log is sealed by the next
+ * alert after it becomes due, not at the exact size/age boundary.
+ * * If sealing fails (e.g. the volume is full) it is retried only after
+ * seal_retry_seconds, and the active segment is capped at max_segment_bytes:
+ * further alerts are counted and dropped until a seal succeeds, so disk
+ * usage stays bounded by one active segment plus the retention budget.
  * * @param message: The plain-text alert message.
  */
 void Monitor::log_alert(const std::string& message) {
@@ -209,17 +564,49 @@ void Monitor::log_alert(const std::string& message) {
     std::lock_guard<std::mutex> lock(mtx); 
     
     std::string encrypted = aes_256_encrypt(message, key);
-    std::string hex_encrypted = to_hex(encrypted);
+    std::string line = to_hex(encrypted) + "\n";
 
-    
-    // Open in append and binary mode to prevent OS-specific line-ending corruption
-    std::ofstream log_file(log_filename, std::ios::app | std::ios::binary);
+    if (!log_stream && !open_active_segment()) return;
 
-    if(!log_file.is_open()) return;
-    
-    log_file << hex_encrypted << "\n";
+    // Seal before this write would cross a limit (never seal an empty segment)
+    bool too_big = rotation.max_segment_bytes > 0 &&
+                   segment_bytes + line.size() > rotation.max_segment_bytes;
+    bool too_old = rotation.max_segment_age_seconds > 0 &&
+                   std::chrono::system_clock::now() - segment_started >=
+                       std::chrono::seconds(rotation.max_segment_age_seconds);
+    auto now = std::chrono::steady_clock::now();
+    if (segment_bytes > 0 && (too_big || too_old) && now >= seal_retry_after) {
+        if (seal_active_segment()) {
+            seal_retry_after = std::chrono::steady_clock::time_point();
+        } else {
+            seal_retry_after = now + std::chrono::seconds(rotation.seal_retry_seconds);
+            std::cerr << "[Monitor] Log rotation failed; retrying in "
+                      << rotation.seal_retry_seconds << "s.\n";
+        }
+        if (!log_stream && !open_active_segment()) return;
+    }
+
+    // Hard cap: while sealing is failing, refuse to grow past the segment limit
+    auto over_cap = [&](std::size_t bytes) {
+        return rotation.max_segment_bytes > 0 && segment_bytes > 0 &&
+               segment_bytes + bytes > rotation.max_segment_bytes;
+    };
+    if (over_cap(line.size())) {
+        ++dropped_alerts;
+        return;
+    }
+
+    // Record how many alerts were lost once there is room again
+    if (dropped_alerts > 0) {
+        std::string notice = "NOTICE: " + std::to_string(dropped_alerts) +
+                             " alerts dropped while log rotation was failing";
+        std::string notice_line = to_hex(aes_256_encrypt(notice, key)) + "\n";
+        if (!over_cap(notice_line.size() + line.size()) && append_line(notice_line)) {
+            dropped_alerts = 0;
+        }
+    }
 
-    log_file.close();
+    if (!append_line(line)) ++dropped_alerts;
 }
 
 /**
@@ -320,6 +707,7 @@ void Monitor::run_monitoring_cycle(int interval_seconds) {
     while(true) {
         // --- 1. SENSOR READINGS ---
         
+        refresh_sensors();
         float current_load = read_system_load();
         float current_ram = read_ram_usage();
         
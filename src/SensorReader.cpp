@@ -0,0 +1,311 @@
+#include "../include/SensorReader.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+/**
+ * --- OPTIONAL io_uring BACKEND ---
+ * Enabled by the DEEPGUARD_IO_URING CMake option. We talk to the kernel
+ * through the raw syscalls so no extra library (liburing) is required.
+ */
+#ifdef DEEPGUARD_IO_URING
+    #include <linux/io_uring.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <sys/uio.h>
+#endif
+
+#ifdef DEEPGUARD_IO_URING
+// Largest ring we ask for; bigger sensor sets are submitted in several batches
+static const unsigned MAX_RING_ENTRIES = 256;
+
+static int sys_io_uring_setup(unsigned entries, io_uring_params* p) {
+    return (int)syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+    return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+static int sys_io_uring_register(int fd, unsigned opcode, const void* arg, unsigned nr_args) {
+    return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+#endif
+
+SensorReader::SensorReader(const std::vector<std::string>& sensor_paths, std::size_t buf_size)
+    : paths(sensor_paths), fds(sensor_paths.size(), -1), buffers(sensor_paths.size() * buf_size),
+      lengths(sensor_paths.size(), -1), overflow(sensor_paths.size()), buffer_size(buf_size),
+      ring_fd(-1), ring_entries(0), sq_ring(nullptr), cq_ring(nullptr), sqes(nullptr),
+      sq_ring_size(0), cq_ring_size(0), sqes_size(0),
+      sq_tail(nullptr), sq_array(nullptr), sq_mask(0),
+      cq_head(nullptr), cq_tail(nullptr), cq_mask(0), cqes(nullptr) {
+    // Open every sensor once; each tick only re-reads from offset 0
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+        fds[i] = open(paths[i].c_str(), O_RDONLY | O_CLOEXEC);
+    }
+
+    if (!setup_io_uring()) teardown_io_uring();
+}
+
+SensorReader::~SensorReader() {
+    teardown_io_uring();
+    for (int fd : fds) {
+        if (fd >= 0) close(fd);
+    }
+}
+
+/**
+ * @brief Creates the ring and registers the sensor descriptors and buffers.
+ * * Registration happens once so each tick avoids the per-request fd lookup
+ * and page pinning. Any failure (old kernel, seccomp, io_uring_disabled)
+ * simply leaves the reader on the pread path.
+ */
+bool SensorReader::setup_io_uring() {
+#ifdef DEEPGUARD_IO_URING
+    if (paths.empty()) return false;
+
+    unsigned entries = 1;
+    while (entries < paths.size() && entries < MAX_RING_ENTRIES) entries <<= 1;
+
+    io_uring_params ring_params;
+    std::memset(&ring_params, 0, sizeof(ring_params));
+    ring_fd = sys_io_uring_setup(entries, &ring_params);
+    if (ring_fd < 0) {
+        ring_fd = -1;
+        return false;
+    }
+    ring_entries = ring_params.sq_entries;
+
+    // Map the submission/completion rings (single mmap when the kernel supports it)
+    sq_ring_size = ring_params.sq_off.array + ring_params.sq_entries * sizeof(unsigned);
+    cq_ring_size = ring_params.cq_off.cqes + ring_params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = (ring_params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap && cq_ring_size > sq_ring_size) sq_ring_size = cq_ring_size;
+
+    sq_ring = mmap(NULL, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                   ring_fd, IORING_OFF_SQ_RING);
+    if (sq_ring == MAP_FAILED) {
+        sq_ring = nullptr;
+        return false;
+    }
+
+    if (single_mmap) {
+        cq_ring = sq_ring;
+    } else {
+        cq_ring = mmap(NULL, cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                       ring_fd, IORING_OFF_CQ_RING);
+        if (cq_ring == MAP_FAILED) {
+            cq_ring = nullptr;
+            return false;
+        }
+    }
+
+    sqes_size = ring_params.sq_entries * sizeof(io_uring_sqe);
+    sqes = mmap(NULL, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                ring_fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        sqes = nullptr;
+        return false;
+    }
+
+    // Resolve the ring fields once so each tick only dereferences pointers
+    char* sq_base = static_cast<char*>(sq_ring);
+    char* cq_base = static_cast<char*>(cq_ring);
+    sq_tail = reinterpret_cast<unsigned*>(sq_base + ring_params.sq_off.tail);
+    sq_array = reinterpret_cast<unsigned*>(sq_base + ring_params.sq_off.array);
+    sq_mask = *reinterpret_cast<unsigned*>(sq_base + ring_params.sq_off.ring_mask);
+    cq_head = reinterpret_cast<unsigned*>(cq_base + ring_params.cq_off.head);
+    cq_tail = reinterpret_cast<unsigned*>(cq_base + ring_params.cq_off.tail);
+    cq_mask = *reinterpret_cast<unsigned*>(cq_base + ring_params.cq_off.ring_mask);
+    cqes = cq_base + ring_params.cq_off.cqes;
+
+    // Register descriptors; failed opens stay as -1 (sparse slots are allowed)
+    if (sys_io_uring_register(ring_fd, IORING_REGISTER_FILES, fds.data(), (unsigned)fds.size()) < 0) {
+        return false;
+    }
+
+    // Register one iovec per sensor, all pointing into the contiguous buffer block
+    std::vector<iovec> iovs(paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+        iovs[i].iov_base = buffers.data() + i * buffer_size;
+        iovs[i].iov_len = buffer_size;
+    }
+    if (sys_io_uring_register(ring_fd, IORING_REGISTER_BUFFERS, iovs.data(), (unsigned)iovs.size()) < 0) {
+        return false;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+void SensorReader::teardown_io_uring() {
+#ifdef DEEPGUARD_IO_URING
+    if (sqes) munmap(sqes, sqes_size);
+    if (cq_ring && cq_ring != sq_ring) munmap(cq_ring, cq_ring_size);
+    if (sq_ring) munmap(sq_ring, sq_ring_size);
+    if (ring_fd >= 0) close(ring_fd); // Closing the ring drops registered files/buffers
+#endif
+    sqes = nullptr;
+    cq_ring = nullptr;
+    sq_ring = nullptr;
+    ring_fd = -1;
+    ring_entries = 0;
+}
+
+/**
+ * @brief Submits READ_FIXED for every open sensor and waits for all completions.
+ * * One io_uring_enter() per batch both submits and reaps, so a tick costs a
+ * single syscall for up to ring_entries files instead of open/read/close each.
+ * Reads the kernel rejects (e.g. a file without read_iter) are retried via pread.
+ * @return false if the ring itself failed and the caller should switch to pread.
+ */
+bool SensorReader::read_all_io_uring() {
+#ifdef DEEPGUARD_IO_URING
+    io_uring_cqe* cqe_array = static_cast<io_uring_cqe*>(cqes);
+    io_uring_sqe* sqe_array = static_cast<io_uring_sqe*>(sqes);
+
+    std::size_t next = 0;
+    while (next < paths.size()) {
+        // --- 1. FILL THE SUBMISSION QUEUE ---
+        unsigned tail = *sq_tail;
+        unsigned queued = 0;
+        while (next < paths.size() && queued < ring_entries) {
+            std::size_t i = next++;
+            if (fds[i] < 0) continue;
+
+            unsigned slot = tail & sq_mask;
+            io_uring_sqe* sqe = &sqe_array[slot];
+            std::memset(sqe, 0, sizeof(*sqe));
+            sqe->opcode = IORING_OP_READ_FIXED;
+            sqe->flags = IOSQE_FIXED_FILE;
+            sqe->fd = (int)i;              // Index into the registered file table
+            sqe->off = 0;                  // /proc and sysfs regenerate at offset 0
+            sqe->addr = (unsigned long long)(buffers.data() + i * buffer_size);
+            sqe->len = (unsigned)buffer_size;
+            sqe->buf_index = (unsigned short)i;
+            sqe->user_data = i;
+            sq_array[slot] = slot;
+            ++tail;
+            ++queued;
+        }
+        if (queued == 0) continue;
+
+        // Publish the new tail only after the entries are fully written
+        __atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+
+        // --- 2. SUBMIT AND WAIT IN ONE SYSCALL ---
+        int res;
+        do {
+            res = sys_io_uring_enter(ring_fd, queued, queued, IORING_ENTER_GETEVENTS);
+        } while (res < 0 && errno == EINTR);
+        if (res < 0) return false;
+
+        // A short submit means the kernel stopped at an SQE it could not prep and
+        // left the rest in the SQ. Reap what was submitted, then give up on the ring.
+        unsigned submitted = (unsigned)res;
+
+        // --- 3. REAP COMPLETIONS ---
+        unsigned reaped = 0;
+        while (reaped < submitted) {
+            unsigned head = *cq_head;
+            unsigned ctail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+            if (head == ctail) {
+                do {
+                    res = sys_io_uring_enter(ring_fd, 0, submitted - reaped, IORING_ENTER_GETEVENTS);
+                } while (res < 0 && errno == EINTR);
+                if (res < 0) return false;
+                continue;
+            }
+            for (; head != ctail; ++head, ++reaped) {
+                const io_uring_cqe& cqe = cqe_array[head & cq_mask];
+                std::size_t i = (std::size_t)cqe.user_data;
+                if (cqe.res >= 0) {
+                    lengths[i] = cqe.res;
+                } else {
+                    read_one_pread(i);
+                }
+            }
+            __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+        }
+        if (submitted < queued) return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void SensorReader::read_one_pread(std::size_t index) {
+    lengths[index] = -1;
+    if (fds[index] < 0) return;
+
+    ssize_t n;
+    do {
+        n = pread(fds[index], buffers.data() + index * buffer_size, buffer_size, 0);
+    } while (n < 0 && errno == EINTR);
+    lengths[index] = (long)n;
+}
+
+/**
+ * @brief Reads whatever did not fit in the fixed buffer of file 'index'.
+ * * Only files that filled their buffer get here (e.g. /proc/stat on many-core
+ * hosts), so the common case stays one read per file. The tail is read with
+ * pread() from the end of the buffer; /proc regenerates the file per read, so
+ * the tail may come from a slightly later snapshot than the head.
+ */
+void SensorReader::read_overflow(std::size_t index) {
+    overflow[index].clear();
+
+    std::vector<char> chunk(buffer_size);
+    off_t offset = (off_t)buffer_size;
+    while (true) {
+        ssize_t n;
+        do {
+            n = pread(fds[index], chunk.data(), chunk.size(), offset);
+        } while (n < 0 && errno == EINTR);
+        if (n <= 0) break;
+        overflow[index].append(chunk.data(), (std::size_t)n);
+        offset += n;
+    }
+}
+
+/**
+ * @brief Refreshes every sensor buffer for the current tick.
+ * * Uses the io_uring batch when available. If the ring fails mid-flight it is
+ * torn down for good and this and all later ticks use pread().
+ * @return true if at least one sensor was read successfully.
+ */
+bool SensorReader::read_all() {
+    for (long& len : lengths) len = -1;
+
+    if (using_io_uring() && !read_all_io_uring()) {
+        teardown_io_uring();
+        for (long& len : lengths) len = -1;
+    }
+    if (!using_io_uring()) {
+        for (std::size_t i = 0; i < paths.size(); ++i) read_one_pread(i);
+    }
+
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+        if (lengths[i] == (long)buffer_size) {
+            read_overflow(i);
+        } else {
+            overflow[i].clear();
+        }
+    }
+
+    for (long len : lengths) {
+        if (len >= 0) return true;
+    }
+    return false;
+}
+
+std::string SensorReader::contents(std::size_t index) const {
+    if (index >= lengths.size() || lengths[index] < 0) return "";
+    std::string data(buffers.data() + index * buffer_size, (std::size_t)lengths[index]);
+    data += overflow[index];
+    return data;
+}
@@ -7,8 +7,12 @@
 /**
  * DEEP GUARD - Main Entry Point
  * Handles user configuration and initializes the monitoring engine.
+ *
+ * Usage:
+ *   deepguard                          Interactive setup, then monitor
+ *   deepguard --read-segment <file>    Print the alerts in a sealed log segment
  */
-int main() {
+int main(int argc, char* argv[]) {
     // 1. Fetch the secret key safely via the Config module (Environment variable)
     // This keeps the actual password out of your source code for safety.
     std::string secret_key = Config::get_encryption_key();
@@ -18,6 +22,19 @@ int main() {
         std::cerr << "CRITICAL ERROR: Environment variable MONITOR_KEY is not set.\n";
         return 1;
     }
+
+    // Read-back mode: decrypt + decompress a sealed <log>.<seq>.seg file
+    if (argc == 3 && std::string(argv[1]) == "--read-segment") {
+        Monitor reader(0.0f, 0.0f, "", secret_key);
+        std::vector<std::string> lines = reader.read_sealed_segment(argv[2]);
+        if (lines.empty()) {
+            std::cerr << "Unable to read segment " << argv[2]
+                      << " (missing, corrupt, or encrypted with a different MONITOR_KEY).\n";
+            return 1;
+        }
+        for (const auto& line : lines) std::cout << line << "\n";
+        return 0;
+    }
     
     float threshold;
     float ram_threshold;
@@ -63,8 +80,9 @@ int main() {
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
     }
 
-    // 5. Create Monitor instance
-    Monitor sys_monitor(threshold, ram_threshold, log_file, secret_key);
+    // 5. Create Monitor instance (default rotation: 1 MB / 24 h segments, 16 MB retained)
+    LogRotationPolicy rotation;
+    Monitor sys_monitor(threshold, ram_threshold, log_file, secret_key, rotation);
 
     // 6. Display current system statistics before starting monitoring
     std::cout << "\n========================================\n";
@@ -109,6 +127,9 @@ int main() {
     std::cout << "  MONITORING CONFIGURATION\n";
     std::cout << "========================================\n";
     std::cout << "  Target Log:       " << log_file << "\n";
+    std::cout << "  Log Rotation:     " << rotation.max_segment_bytes / 1024 << " KB or "
+              << rotation.max_segment_age_seconds / 3600 << " h per segment, "
+              << rotation.retention_bytes / (1024 * 1024) << " MB retained\n";
     std::cout << "  CPU Threshold:    " << threshold << "\n";
     std::cout << "  RAM Threshold:    " << ram_threshold << " %\n";
     std::cout << "  Check Interval:   " << interval << " seconds\n";
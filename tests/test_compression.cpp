@@ -0,0 +1,70 @@
+#include "../include/Compression.h"
+#include <iostream>
+#include <random>
+#include <string>
+
+/**
+ * Round-trip tests for the built-in LZ compressor used by sealed log segments.
+ */
+static int failures = 0;
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        if (!(cond)) {                                                       \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": FAILED: " #cond "\n"; \
+            ++failures;                                                      \
+        }                                                                    \
+    } while (0)
+
+static bool round_trips(const std::string& input) {
+    std::string output;
+    return Compression::decompress(Compression::compress(input), output) && output == input;
+}
+
+int main() {
+    // --- Edge cases ---
+    CHECK(round_trips(""));
+    CHECK(round_trips("a"));
+    CHECK(round_trips("abcd"));
+    CHECK(round_trips(std::string(100000, 'x')));   // Long overlapping match
+
+    // --- Realistic alert log compresses well ---
+    std::string log;
+    for (int i = 0; i < 1000; ++i) {
+        log += "CRITICAL: Load=" + std::to_string(i % 7) + " | RAM=81.2% | Disk=40% | DB=DOWN\n";
+    }
+    CHECK(round_trips(log));
+    CHECK(Compression::compress(log).size() < log.size() / 10);
+
+    // --- Random data of varying entropy ---
+    std::mt19937 rng(42);
+    for (int t = 0; t < 500; ++t) {
+        std::string input;
+        std::size_t length = rng() % 20000;
+        unsigned alphabet = 1 + rng() % 256;
+        for (std::size_t i = 0; i < length; ++i) input.push_back((char)(rng() % alphabet));
+        CHECK(round_trips(input));
+    }
+
+    // --- Corrupt input is rejected, not crashed on ---
+    std::string output;
+    CHECK(!Compression::decompress("", output));
+    std::string block = Compression::compress(log);
+    CHECK(!Compression::decompress(block.substr(0, block.size() / 2), output));
+    for (int t = 0; t < 2000; ++t) {
+        std::string damaged = block;
+        // Header bytes (0-3) included: a forged size must not drive allocation
+        damaged[rng() % damaged.size()] ^= (char)(1 + rng() % 255);
+        if (Compression::decompress(damaged, output)) CHECK(output.size() <= damaged.size() * 255);
+        CHECK(output.capacity() <= damaged.size() * 255 + log.size());
+    }
+
+    // A forged 4 GB size header on a 6-byte block is rejected without reserving it
+    std::string forged("\xff\xff\xff\xff\x10\x61", 6);
+    std::string fresh;
+    CHECK(!Compression::decompress(forged, fresh));
+    CHECK(fresh.capacity() < 1024 * 1024);
+
+    if (failures == 0) std::cout << "test_compression: all checks passed\n";
+    return failures == 0 ? 0 : 1;
+}
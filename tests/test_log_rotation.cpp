@@ -0,0 +1,207 @@
+#include "../include/Monitor.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+/**
+ * Log rotation tests: sealed segments read back, failed seals stay bounded,
+ * retention frees space before a seal (and on ENOSPC), segment age survives
+ * restarts, and odd file names are ignored.
+ */
+namespace fs = std::filesystem;
+
+static int failures = 0;
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        if (!(cond)) {                                                       \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": FAILED: " #cond "\n"; \
+            ++failures;                                                      \
+        }                                                                    \
+    } while (0)
+
+static const std::string KEY = "test-key";
+
+static fs::path fresh_dir(const std::string& name) {
+    fs::path dir = fs::temp_directory_path() / ("deepguard_" + name);
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    return dir;
+}
+
+static std::string alert(int i) {
+    return "CRITICAL: Load=" + std::to_string(i) + " | RAM=81% | Disk=40% | DB=DOWN";
+}
+
+static void test_seal_and_read_back() {
+    fs::path dir = fresh_dir("readback");
+    std::string log = (dir / "alerts.log").string();
+
+    LogRotationPolicy policy;
+    policy.max_segment_bytes = 4096;
+    policy.retention_bytes = 0;
+    Monitor monitor(0.0f, 0.0f, log, KEY, policy);
+    for (int i = 0; i < 200; ++i) monitor.log_alert(alert(i));
+
+    CHECK(fs::exists(log + ".1.seg"));
+    CHECK(fs::file_size(log) <= 4096 + 64);
+
+    // Every alert is in exactly one sealed segment or still in the active file
+    int next = 0;
+    for (int seq = 1; fs::exists(log + "." + std::to_string(seq) + ".seg"); ++seq) {
+        auto lines = monitor.read_sealed_segment(log + "." + std::to_string(seq) + ".seg");
+        CHECK(!lines.empty());
+        for (const auto& line : lines) CHECK(line == alert(next++));
+    }
+    CHECK(next > 0 && next < 200);
+
+    // Wrong key cannot read it back
+    Monitor other(0.0f, 0.0f, log, "other-key", policy);
+    CHECK(other.read_sealed_segment(log + ".1.seg").empty());
+}
+
+static void test_failed_seal_is_bounded() {
+    fs::path dir = fresh_dir("sealfail");
+    std::string log = (dir / "alerts.log").string();
+
+    // A directory where the temp file should go makes every seal fail
+    fs::create_directories(log + ".1.seg.tmp");
+
+    LogRotationPolicy policy;
+    policy.max_segment_bytes = 4096;
+    auto start = std::chrono::steady_clock::now();
+    {
+        Monitor monitor(0.0f, 0.0f, log, KEY, policy);
+        for (int i = 0; i < 2000; ++i) monitor.log_alert(alert(i));
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    CHECK(!fs::exists(log + ".1.seg"));
+    CHECK(fs::file_size(log) <= 4096 + 64);
+    CHECK(elapsed < std::chrono::seconds(2));
+}
+
+// Seals 200 alerts into 4 KB segments and returns the number of sealed segments
+static int make_segments(const std::string& log) {
+    LogRotationPolicy policy;
+    policy.max_segment_bytes = 4096;
+    policy.retention_bytes = 0;
+    Monitor monitor(0.0f, 0.0f, log, KEY, policy);
+    for (int i = 0; i < 200; ++i) monitor.log_alert(alert(i));
+
+    int count = 0;
+    while (fs::exists(log + "." + std::to_string(count + 1) + ".seg")) ++count;
+    return count;
+}
+
+static std::string seg(const std::string& log, int seq) {
+    return log + "." + std::to_string(seq) + ".seg";
+}
+
+static void test_retention_counts_incoming_segment() {
+    fs::path dir = fresh_dir("retention");
+    std::string log = (dir / "alerts.log").string();
+    int count = make_segments(log);
+    CHECK(count >= 3);
+
+    unsigned long long total = 0;
+    for (int i = 1; i <= count; ++i) total += fs::file_size(seg(log, i));
+
+    // Sealed segments sit exactly at the budget, and the next seal will fail.
+    // Eviction must still happen first, counting the segment about to be written.
+    fs::create_directories(seg(log, count + 1) + ".tmp");
+
+    LogRotationPolicy policy;
+    policy.max_segment_bytes = 4096;
+    policy.retention_bytes = total;
+    {
+        Monitor monitor(0.0f, 0.0f, log, KEY, policy);
+        for (int i = 0; i < 100; ++i) monitor.log_alert(alert(i));
+    }
+
+    CHECK(!fs::exists(seg(log, 1)));
+    CHECK(fs::exists(seg(log, count)));
+    CHECK(!fs::exists(seg(log, count + 1)));
+}
+
+static void test_enospc_evicts_oldest_and_retries() {
+#ifdef __linux__
+    if (!fs::exists("/dev/full")) return;
+
+    fs::path dir = fresh_dir("enospc");
+    std::string log = (dir / "alerts.log").string();
+    int count = make_segments(log);
+    CHECK(count >= 2);
+
+    // Writes to /dev/full fail with ENOSPC, like a full volume
+    fs::create_symlink("/dev/full", seg(log, count + 1) + ".tmp");
+
+    LogRotationPolicy policy;
+    policy.max_segment_bytes = 4096;
+    policy.retention_bytes = 0;   // No budget: only ENOSPC may evict
+    {
+        Monitor monitor(0.0f, 0.0f, log, KEY, policy);
+        for (int i = 0; i < 100; ++i) monitor.log_alert(alert(i));
+
+        // Oldest segment traded for the new one; the retry landed as a real file
+        CHECK(!fs::exists(seg(log, 1)));
+        CHECK(fs::exists(seg(log, 2)));
+        CHECK(!fs::is_symlink(seg(log, count + 1)));
+        CHECK(!monitor.read_sealed_segment(seg(log, count + 1)).empty());
+    }
+#endif
+}
+
+static void test_age_survives_restart() {
+    fs::path dir = fresh_dir("age");
+    std::string log = (dir / "alerts.log").string();
+
+    LogRotationPolicy policy;
+    policy.max_segment_age_seconds = 60;
+    {
+        Monitor monitor(0.0f, 0.0f, log, KEY, policy);
+        monitor.log_alert(alert(0));
+    }
+
+    // Backdate the header as if the segment was started two hours ago
+    std::ifstream in(log, std::ios::binary);
+    std::string header, rest;
+    std::getline(in, header);
+    std::getline(in, rest, '\0');
+    in.close();
+    long long started = std::stoll(header.substr(header.find(' ') + 1));
+    std::ofstream out(log, std::ios::binary | std::ios::trunc);
+    out << "#segment-start " << (started - 7200) << "\n" << rest;
+    out.close();
+
+    {
+        Monitor restarted(0.0f, 0.0f, log, KEY, policy);
+        restarted.log_alert(alert(1));
+        auto lines = restarted.read_sealed_segment(log + ".1.seg");
+        CHECK(lines.size() == 1 && lines[0] == alert(0));
+    }
+}
+
+static void test_ignores_unparseable_segment_names() {
+    fs::path dir = fresh_dir("names");
+    std::string log = (dir / "alerts.log").string();
+    std::ofstream(log + ".99999999999999999999999.seg") << "x";
+
+    Monitor monitor(0.0f, 0.0f, log, KEY);
+    monitor.log_alert(alert(0));   // Must not throw
+    CHECK(fs::exists(log));
+}
+
+int main() {
+    test_seal_and_read_back();
+    test_failed_seal_is_bounded();
+    test_retention_counts_incoming_segment();
+    test_enospc_evicts_oldest_and_retries();
+    test_age_survives_restart();
+    test_ignores_unparseable_segment_names();
+
+    if (failures == 0) std::cout << "test_log_rotation: all checks passed\n";
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+#include "../include/SensorReader.h"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+/**
+ * SensorReader tests: files larger than the fixed buffer, missing files, and
+ * repeated reads. Built twice by CMake, with and without DEEPGUARD_IO_URING,
+ * so both the batched path and the pread fallback are covered.
+ */
+namespace fs = std::filesystem;
+
+static int failures = 0;
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        if (!(cond)) {                                                       \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": FAILED: " #cond "\n"; \
+            ++failures;                                                      \
+        }                                                                    \
+    } while (0)
+
+static void write_file(const fs::path& path, const std::string& data) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << data;
+}
+
+int main() {
+#ifdef DEEPGUARD_IO_URING
+    fs::path dir = fs::temp_directory_path() / "deepguard_sensor_reader_io_uring";
+#else
+    fs::path dir = fs::temp_directory_path() / "deepguard_sensor_reader_pread";
+#endif
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    // 18 KB of distinct lines so a truncated or misordered tail is detectable
+    std::string large;
+    for (int i = 0; large.size() < 18 * 1024; ++i) large += "line " + std::to_string(i) + "\n";
+    std::string small = "0.42 0.10 0.05 1/100 1234\n";
+    std::string exact(4096, 'e');   // Exactly one buffer: takes the overflow path, finds nothing
+
+    write_file(dir / "large", large);
+    write_file(dir / "small", small);
+    write_file(dir / "exact", exact);
+
+    SensorReader reader({(dir / "large").string(), (dir / "missing").string(),
+                         (dir / "small").string(), (dir / "exact").string()}, 4096);
+
+#ifdef DEEPGUARD_IO_URING
+    std::cout << "test_sensor_reader: io_uring " << (reader.using_io_uring() ? "active" : "unavailable, using pread") << "\n";
+#else
+    CHECK(!reader.using_io_uring());
+#endif
+
+    for (int tick = 0; tick < 3; ++tick) {
+        CHECK(reader.read_all());
+        CHECK(reader.contents(0) == large);
+        CHECK(reader.contents(1).empty());
+        CHECK(reader.contents(2) == small);
+        CHECK(reader.contents(3) == exact);
+        CHECK(reader.contents(99).empty());
+    }
+
+    // Files are re-read each tick, not cached from the first read
+    std::string shorter = "1.00\n";
+    write_file(dir / "small", shorter);
+    write_file(dir / "large", small);
+    CHECK(reader.read_all());
+    CHECK(reader.contents(2) == shorter);
+    CHECK(reader.contents(0) == small);
+
+    // Nothing readable: read_all reports failure
+    SensorReader none({(dir / "missing").string()});
+    CHECK(!none.read_all());
+    CHECK(none.contents(0).empty());
+
+    // Real /proc files come back non-empty
+    SensorReader proc({"/proc/loadavg", "/proc/meminfo"});
+    CHECK(proc.read_all());
+    CHECK(!proc.contents(0).empty());
+    CHECK(proc.contents(1).find("MemTotal:") == 0);
+
+    fs::remove_all(dir);
+
+    if (failures == 0) std::cout << "test_sensor_reader: all checks passed\n";
+    return failures == 0 ? 0 : 1;
+}